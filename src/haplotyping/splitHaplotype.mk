@@ -1,5 +1,6 @@
 TARGET   := splitHaplotype
-SOURCES  := splitHaplotype.C
+SOURCES  := splitHaplotype.C \
+            hapKmerIndex.C
 
 SRC_INCDIRS  := .. ../utility/src/utility ../stores ../utgcns
 
@@ -58,6 +58,9 @@ SOURCES      := utility/src/utility/runtime.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
+                stores/ovTextConverter.C \
+                \
+                stores/perfTelemetry.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
@@ -77,6 +80,7 @@ SOURCES      := utility/src/utility/runtime.C \
                 overlapInCore/liboverlap/prefixEditDistance.C \
                 overlapInCore/liboverlap/prefixEditDistance-allocateMoreSpace.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
+                overlapInCore/liboverlap/prefixEditDistance-band.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
                 \
@@ -139,6 +143,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 stores/sqStoreDumpMetaData.mk \
                 stores/tgStoreCompress.mk \
                 stores/tgStoreDump.mk \
+                stores/tgStoreAcquireTest.mk \
                 stores/tgStoreLoad.mk \
                 stores/tgTigDisplay.mk \
                 stores/loadCorrectedReads.mk \
@@ -153,8 +158,10 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 overlapInCore/overlapImport.mk \
                 overlapInCore/overlapPair.mk \
                 overlapInCore/edalign.mk \
+                overlapInCore/alignBenchmark.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
+                overlapInCore/liboverlap/prefixEditDistance-benchmark.mk \
                 \
                 mhap/mhapConvert.mk \
                 \
@@ -184,6 +191,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 bogart/layoutReads.mk \
                 \
                 bogus/bogus.mk \
+                bogus/bogusSimulate.mk \
                 \
                 utgcns/utgcns.mk \
                 \
@@ -0,0 +1,8 @@
+TARGET   := alignBenchmark
+SOURCES  := alignBenchmark.C
+
+SRC_INCDIRS  := .. ../utility/src/utility ../stores libedlib liboverlap ../utgcns/libNDalign
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
@@ -0,0 +1,195 @@
+#!/usr/bin/env perl
+
+###############################################################################
+ #
+ #  This file is part of canu, a software program that assembles whole-genome
+ #  sequencing reads into contigs.
+ #
+ #  This software is based on:
+ #    'Celera Assembler' r4587 (http://wgs-assembler.sourceforge.net)
+ #    the 'kmer package' r1994 (http://kmer.sourceforge.net)
+ #
+ #  Except as indicated otherwise, this is a 'United States Government Work',
+ #  and is released in the public domain.
+ #
+ #  File 'README.licenses' in the root directory of this distribution
+ #  contains full conditions and disclaimers.
+ ##
+
+use strict;
+
+use FindBin;
+use File::Find;
+use JSON::PP;
+
+#  Simulates genomes and reads of several sizes with bogusSimulate, assembles
+#  each with canu at several thread counts, and reports how each binary
+#  scales, using the *.perf.json files the binaries leave behind.
+#
+#  Everything runs on the local machine; nothing is downloaded.  Re-running
+#  reuses any simulations and assemblies that already finished.
+
+my $bin      = $FindBin::RealBin;
+my $wrk      = "canu-scaling";
+
+my @sizes    = (1000000, 4000000);
+my @threads  = (1, 2, 4, 8);
+
+my $seed     = 1;
+my $coverage = 30;
+my $readLen  = "10000 3000";
+my $errors   = "0.01 0.34 0.33 0.33";
+my @repeats;
+my $het      = 0;
+
+my @canuOpts;
+
+while (scalar(@ARGV) > 0) {
+    my $arg = shift @ARGV;
+
+    if    ($arg eq "-bin")        {  $bin      = shift @ARGV;                          }
+    elsif ($arg eq "-d")          {  $wrk      = shift @ARGV;                          }
+    elsif ($arg eq "-sizes")      {  @sizes    = split ',', shift @ARGV;               }
+    elsif ($arg eq "-threads")    {  @threads  = split ',', shift @ARGV;               }
+    elsif ($arg eq "-seed")       {  $seed     = shift @ARGV;                          }
+    elsif ($arg eq "-coverage")   {  $coverage = shift @ARGV;                          }
+    elsif ($arg eq "-readlength") {  $readLen  = join " ", splice(@ARGV, 0, 2);        }
+    elsif ($arg eq "-errors")     {  $errors   = join " ", splice(@ARGV, 0, 4);        }
+    elsif ($arg eq "-repeat")     {  push @repeats, join " ", splice(@ARGV, 0, 3);     }
+    elsif ($arg eq "-het")        {  $het      = shift @ARGV;                          }
+    elsif ($arg =~ m/=/)          {  push @canuOpts, $arg;                             }
+
+    else {
+        print STDERR "usage: $0 [options] [canu-option=value ...]\n";
+        print STDERR "\n";
+        print STDERR "  -bin dir                 canu binaries (default: where this script is)\n";
+        print STDERR "  -d dir                   work directory (default: canu-scaling)\n";
+        print STDERR "  -sizes s1,s2,...         genome sizes (default: 1000000,4000000)\n";
+        print STDERR "  -threads t1,t2,...       thread counts (default: 1,2,4,8)\n";
+        print STDERR "\n";
+        print STDERR "  -seed s                  passed to bogusSimulate, along with\n";
+        print STDERR "  -coverage c                any of these\n";
+        print STDERR "  -readlength mean sd\n";
+        print STDERR "  -errors e s i d\n";
+        print STDERR "  -repeat n len ident      (may be repeated)\n";
+        print STDERR "  -het rate\n";
+        print STDERR "\n";
+        print STDERR "  Any option containing '=' is passed to canu.\n";
+        exit(1);
+    }
+}
+
+die "Didn't find 'canu' and 'bogusSimulate' in '$bin'; use -bin.\n"   if ((! -x "$bin/canu") || (! -x "$bin/bogusSimulate"));
+
+system("mkdir -p $wrk")  if (! -d $wrk);
+
+#  Load the perf.json files under an assembly, summing over all runs of each
+#  program.  Wall and CPU time add up; peak memory is the max.
+
+sub loadTelemetry ($) {
+    my $dir = shift @_;
+    my %perf;
+
+    find(sub {
+        return   if ($_ !~ m/perf.json$/);
+
+        open(F, "< $_") or die "Failed to open '$File::Find::name' for reading: $!\n";
+        my $json = decode_json(do { local $/; <F> });
+        close(F);
+
+        my $p = $json->{"name"};
+
+        $perf{$p}{"runs"}    += 1;
+        $perf{$p}{"wall"}    += $json->{"wallSeconds"};
+        $perf{$p}{"cpu"}     += $json->{"userSeconds"} + $json->{"systemSeconds"};
+        $perf{$p}{"rss"}      = $json->{"peakRSSBytes"}   if ($perf{$p}{"rss"} < $json->{"peakRSSBytes"});
+        $perf{$p}{"read"}    += $json->{"bytesRead"};
+        $perf{$p}{"written"} += $json->{"bytesWritten"};
+    }, $dir);
+
+    return(\%perf);
+}
+
+#  Simulate and assemble.
+
+my %results;
+
+foreach my $size (@sizes) {
+    my $sim = "$wrk/sim-$size";
+
+    if (! -e "$sim.reads.fasta") {
+        my $cmd;
+
+        $cmd  = "$bin/bogusSimulate -o $sim -seed $seed -length $size";
+        $cmd .= " -coverage $coverage -readlength $readLen -errors $errors";
+        $cmd .= " -repeat $_"   foreach (@repeats);
+        $cmd .= " -het $het"    if ($het > 0);
+        $cmd .= " > $sim.err 2>&1";
+
+        print STDERR "-- Simulating $size bp.\n";
+
+        system($cmd) == 0 or die "bogusSimulate failed; see '$sim.err'.\n";
+    }
+
+    foreach my $t (@threads) {
+        my $asm = "$wrk/asm-$size-t$t";
+
+        if (! -e "$asm/asm.contigs.fasta") {
+            my $cmd;
+
+            $cmd  = "$bin/canu -p asm -d $asm";
+            $cmd .= " genomeSize=$size useGrid=false maxThreads=$t";
+            $cmd .= " $_"   foreach (@canuOpts);
+            $cmd .= " -trimmed -pacbio $sim.reads.fasta";
+            $cmd .= " > $asm.err 2>&1";
+
+            print STDERR "-- Assembling $size bp with $t thread", ($t == 1) ? "" : "s", ".\n";
+
+            system($cmd) == 0 or die "canu failed; see '$asm.err'.\n";
+        }
+
+        $results{$size}{$t} = loadTelemetry($asm);
+    }
+}
+
+#  Report, one table per binary.
+
+my %programs;
+
+foreach my $size (@sizes) {
+    foreach my $t (@threads) {
+        $programs{$_} = 1   foreach (keys %{$results{$size}{$t}});
+    }
+}
+
+foreach my $p (sort keys %programs) {
+    print "\n";
+    print "$p\n";
+    print "\n";
+    print "      size  threads  runs     wall-sec      cpu-sec  speedup  efficiency   peak-GB    read-GB   write-GB\n";
+    print "----------  -------  ----  -----------  -----------  -------  ----------  --------  ---------  ---------\n";
+
+    foreach my $size (@sizes) {
+        my ($baseWall, $baseThreads);   #  Speedup is relative to the first thread count.
+
+        foreach my $t (@threads) {
+            my $r = $results{$size}{$t}{$p};
+
+            next   if (!defined($r));
+
+            ($baseWall, $baseThreads) = ($r->{"wall"}, $t)   if (!defined($baseWall));
+
+            my $speedup = ($r->{"wall"} > 0) ? ($baseWall / $r->{"wall"}) : 0;
+
+            printf "%10d  %7d  %4d  %11.2f  %11.2f  %6.2fx  %9.1f%%  %8.3f  %9.3f  %9.3f\n",
+                $size, $t, $r->{"runs"},
+                $r->{"wall"}, $r->{"cpu"},
+                $speedup, 100.0 * $speedup * $baseThreads / $t,
+                $r->{"rss"}     / 1024 / 1024 / 1024,
+                $r->{"read"}    / 1024 / 1024 / 1024,
+                $r->{"written"} / 1024 / 1024 / 1024;
+        }
+    }
+}
+
+exit(0);
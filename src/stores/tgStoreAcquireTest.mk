@@ -0,0 +1,8 @@
+TARGET   := tgStoreAcquireTest
+SOURCES  := tgStoreAcquireTest.C
+
+SRC_INCDIRS := .. ../utility/src/utility
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a